@@ -844,13 +844,11 @@ cmd_sampShowRow (int nargs)
  *  Examples:
  */
 
-#define	MAX_ROWSELECT		1024
-
 int
 cmd_sampSelectRowList (int nargs)
 {
     char   tblid[SZ_LINE], url[SZ_LINE], to[SZ_LINE], *arg = NULL;
-    int    i, nrows = 0, stat = OK, rows[MAX_ROWSELECT];
+    int    i, nrows = 0, stat = OK, *rows = NULL;
     struct operand o;
     extern XINT  samp;
 
@@ -865,15 +863,10 @@ cmd_sampSelectRowList (int nargs)
 	    if (strcmp (o.o_val.v_s, "to") == 0)
                 strcpy (to, arg);
 	    else if (isdigit(arg[0])) {
-		/*  Need to decode array/range strings here.     -- FIXME --
+		/*  Decode a row list or ranges, e.g. "1,5,10-20".
 		 */
-		char *ip, *n;
-
-		for (ip=arg, n=arg, nrows=0; n; ip=n ) {
-		    if ( (n = strchr (ip, (int) ',')) )
-			*n++ = '\0';
-		    rows[nrows++] = atoi (ip);
-		}
+		if (rows) free ((void *) rows);
+		rows = samp_decodeRowRanges (arg, &nrows);
 
 	    } else if (strstr (arg, "://"))		/* url		*/
                 strcpy (url, arg);
@@ -886,6 +879,7 @@ cmd_sampSelectRowList (int nargs)
 	}
 
 	stat = samp_tableSelectRowList (samp, to, tblid, url, rows, nrows);
+	if (rows) free ((void *) rows);
 
     } else {			/*  list currently defined metadata  	*/
         cl_error (E_UERR, "sampShowRow: no command specified\n");
@@ -29,7 +29,10 @@ typedef  char  *String;                 /** SAMP String datatype            */
 #define  MAX_MDATTRS         32         /** max metadata attrs 	    	    */
 #define  MAX_SUBS            256        /** max subscriptions allowed       */
 #define  MAX_CLIENTS         32         /** max number of clients 	    */
-#define  MAX_ROWS            256        /** max rows to highlight  	    */
+
+#define  SAMP_ROWS_LIST      0          /** standard 'row-list' encoding    */
+#define  SAMP_ROWS_RANGES    1          /** row range string encoding       */
+#define  SAMP_ROWS_BITMAP    2          /** base64 row bitmap encoding      */
 
 
 /**
@@ -340,6 +343,7 @@ List 	  samp_getAvailableHubs (handle_t handle);
 char     *samp_getActiveHubName (handle_t handle);
 int 	  samp_getActiveHub (handle_t handle);
 int 	  samp_hubInit (handle_t samp, char *appName, char *descr);
+char     *samp_lockfilePath (char *path, int maxch);
 
 int	  samp_processHubEvent (String mtype, Map params);
 int	  samp_hubEvent (String mtype);
@@ -416,10 +420,34 @@ void 	  samp_addFloatParam (Msg msg, char *keyw, float val);
 int 	  samp_paramLen (Msg msg);
 
 
+/* sampRows.c
+ */
+int	  samp_rowEncodings (handle_t handle, String recip);
+int	  samp_addRowListParam (Msg msg, int rows[], int nrows, int enc);
+int	 *samp_getRowList (Map params, int *nrows);
+char     *samp_encodeRowRanges (int rows[], int nrows, int *len);
+char     *samp_encodeRowBitmap (int rows[], int nrows, int *len);
+int	 *samp_decodeRowRanges (char *str, int *nrows);
+int	 *samp_decodeRowBitmap (char *str, int *nrows);
+
+
+/* sampHubServer.c
+ */
+int	  samp_hubServerStart (int port, int verbose);
+int	  samp_hubServerStop (void);
+void	  samp_hubServerStats (int *nclients, long *nmsgs);
+
+
 /* sampLog.c
 */
 void 	  sampLog (handle_t handle, char *format, ...);
 void 	  sampTrace (handle_t handle, char *format, ...);
+void	  samp_logMsg (int cat, int level, char *format, ...);
+void	  samp_logInit (void);
+void	  samp_setLogLevel (int cat, int level);
+int	  samp_getLogLevel (int cat);
+void	  samp_logFlush (void);
+void	  samp_logStats (long *nlogged, long *ndropped);
 
 
 /*  sampUtil.c
@@ -140,14 +140,12 @@ func_sampHubAccess (int nargs)
 {
     struct  operand o;
     int     found = 0, verb;
-    char   *home = envget ("HOME");
     char   path[SZ_LINE];
 
     if (samp >= 0) {
         verb = sampVerbose (samp, -1);
         sampVerbose (samp, 0);
-	memset (path, 0, SZ_LINE);
-	sprintf (path, "%s/.samp", home);
+	samp_lockfilePath (path, SZ_LINE);
 	found = (c_access (path, 0, 0) == YES);
         sampVerbose (samp, verb);
     }
@@ -815,14 +813,12 @@ func_sampShowRow (int nargs)
  *  Usage:   sampSelectRowList (url, id, row [, to])
  */
 
-#define MAX_ROWSELECT           1024
-
 void
 func_sampSelectRowList (int nargs)
 {
-    int    i, nrows = 0, stat = 0, rows[MAX_ROWSELECT];
+    int    nrows = 0, stat = 0, *rows = NULL;
     char   *to=NULL, *srow=NULL, *what=NULL, *tblId=NULL;
-    char   osfn[SZ_PATHNAME], url[SZ_URL], *ip, *n;
+    char   osfn[SZ_PATHNAME], url[SZ_URL];
     struct operand o;
 
 
@@ -857,16 +853,15 @@ func_sampSelectRowList (int nargs)
 
     if (!to)  to = strdup ("all");
 
-    /* Convert the row list string into an int array.
+    /* Convert the row list string, e.g. "1,5,10-20", into an int array.
      */
-    for (ip=srow, n=srow, nrows=0; n; ip=n ) {
-        if ( (n = strchr (ip, (int) ',')) )
-            *n++ = '\0';
-        rows[nrows++] = atoi (ip);
-    }
+    if (srow)
+	rows = samp_decodeRowRanges (srow, &nrows);
 
     stat = samp_tableSelectRowList (samp, to, tblId, url, rows, nrows);
 
+    if (rows)  free ((void *) rows);
+
     if (to)    free ((void *) to);
     if (srow)  free ((void *) srow);
     if (tblId) free ((void *) tblId);